@@ -0,0 +1,249 @@
+#include "AIPlayer.h"
+
+#include <algorithm>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+#include "DistributedSearch.h"
+
+namespace SquadroAI
+{
+
+    namespace
+    {
+        // امتیازهای برد/باخت قطعی به فاصله از ریشه وابسته‌اند؛ در جدول انتقال نسبت به خود گره ذخیره می‌شوند
+        int scoreToTT(int score, int ply)
+        {
+            if (score >= WIN_SCORE - DECISIVE_SCORE_MARGIN)
+                return score + ply;
+            if (score <= LOSS_SCORE + DECISIVE_SCORE_MARGIN)
+                return score - ply;
+            return score;
+        }
+
+        int scoreFromTT(int score, int ply)
+        {
+            if (score >= WIN_SCORE - DECISIVE_SCORE_MARGIN)
+                return score - ply;
+            if (score <= LOSS_SCORE + DECISIVE_SCORE_MARGIN)
+                return score + ply;
+            return score;
+        }
+
+        bool isDecisiveScore(int score)
+        {
+            return score >= WIN_SCORE - DECISIVE_SCORE_MARGIN || score <= LOSS_SCORE + DECISIVE_SCORE_MARGIN;
+        }
+
+        // تعداد گره بین هر بار خواندن ساعت
+        constexpr long long TIME_CHECK_INTERVAL = 1024;
+    }
+
+    AIPlayer::AIPlayer(PlayerID player_id, size_t tt_size_mb)
+        : my_player_id(player_id), transposition_table(tt_size_mb), nodes_searched_total(0)
+    {
+    }
+
+    void AIPlayer::resetSearchState()
+    {
+        transposition_table.clear();
+    }
+
+    std::vector<TTEntry> AIPlayer::exportDeepEntries(int min_depth, size_t max_count) const
+    {
+        return transposition_table.collectDeepEntries(min_depth, max_count);
+    }
+
+    void AIPlayer::importEntries(const std::vector<TTEntry> &entries)
+    {
+        for (const TTEntry &entry : entries)
+            transposition_table.store(entry.zobrist_key_check, entry.depth, entry.score, entry.type, entry.best_move);
+    }
+
+    Move AIPlayer::findBestMove(const GameState &initial_state, std::chrono::milliseconds time_limit)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        if (root_split_coordinator)
+        {
+            try
+            {
+                return root_split_coordinator->findBestMove(initial_state, time_limit).best_move;
+            }
+            catch (const std::runtime_error &e)
+            {
+                std::cerr << "[AIPlayer] Root-split search failed (" << e.what() << "); searching locally." << std::endl;
+            }
+        }
+
+        // حداقل 1ms، چون 0 یعنی بدون محدودیت زمانی
+        SearchLimits limits;
+        limits.time_limit = std::max(std::chrono::milliseconds(1),
+                                     time_limit - std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time));
+        return analyzePosition(initial_state, limits).best_move;
+    }
+
+    SearchReport AIPlayer::analyzePosition(const GameState &initial_state, const SearchLimits &limits)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        node_limit = limits.max_nodes;
+        nodes_searched_current = 0;
+        search_aborted = false;
+
+        SearchReport report;
+        std::vector<Move> root_moves = initial_state.getLegalMoves();
+        if (root_moves.empty())
+            return report;
+        report.best_move = root_moves.front(); // اگر حتی عمق 1 هم کامل نشود
+
+        int max_depth = (limits.max_depth > 0) ? std::min(limits.max_depth, MAX_SEARCH_DEPTH) : MAX_SEARCH_DEPTH;
+
+        // تعمیق تدریجی: نتیجه تکرار ناتمام (به دلیل زمان یا تعداد گره) کنار گذاشته می‌شود
+        for (int depth = 1; depth <= max_depth; ++depth)
+        {
+            MinimaxResult result = searchRoot(initial_state, depth, start_time, limits.time_limit);
+            if (search_aborted)
+                break;
+            if (result.move_found)
+            {
+                report.best_move = result.best_move;
+                report.score = result.score;
+                report.depth_reached = depth;
+            }
+            if (isDecisiveScore(result.score))
+                break;
+        }
+
+        if (report.depth_reached > 0)
+            report.principal_variation = extractPrincipalVariation(initial_state, report.best_move, report.depth_reached);
+        report.nodes_searched = nodes_searched_current;
+        nodes_searched_total += nodes_searched_current;
+        return report;
+    }
+
+    std::vector<Move> AIPlayer::extractPrincipalVariation(const GameState &root_state, const Move &root_move, int max_length) const
+    {
+        std::vector<Move> pv{root_move};
+        GameState state = root_state.createChildState(root_move);
+        while (static_cast<int>(pv.size()) < max_length && !state.isGameOver())
+        {
+            std::optional<TTEntry> entry = transposition_table.probe(state.getZobristHash());
+            if (!entry || entry->best_move == NULL_MOVE)
+                break;
+            std::vector<Move> legal_moves = state.getLegalMoves();
+            if (std::find(legal_moves.begin(), legal_moves.end(), entry->best_move) == legal_moves.end())
+                break; // برخورد هش
+            pv.push_back(entry->best_move);
+            state = state.createChildState(entry->best_move);
+        }
+        return pv;
+    }
+
+    AIPlayer::MinimaxResult AIPlayer::searchRoot(const GameState &root_state, int depth,
+                                                 std::chrono::steady_clock::time_point start_time, std::chrono::milliseconds time_limit)
+    {
+        if (root_state.getCurrentPlayer() == PlayerID::PLAYER_1)
+            return minimaxAlphaBeta<PlayerID::PLAYER_1>(root_state, depth, INT_MIN, INT_MAX, start_time, time_limit, 0);
+        return minimaxAlphaBeta<PlayerID::PLAYER_2>(root_state, depth, INT_MIN, INT_MAX, start_time, time_limit, 0);
+    }
+
+    template <PlayerID SideToMove>
+    AIPlayer::MinimaxResult AIPlayer::minimaxAlphaBeta(const GameState &current_state, int depth, int alpha, int beta,
+                                                       std::chrono::steady_clock::time_point start_time, std::chrono::milliseconds time_limit,
+                                                       int current_ply_from_root)
+    {
+        constexpr PlayerID NEXT_TO_MOVE = PlayerTraits<SideToMove>::OPPONENT;
+        const bool maximizing_player = (SideToMove == my_player_id);
+
+        ++nodes_searched_current;
+        if (node_limit > 0 && nodes_searched_current > node_limit)
+            search_aborted = true;
+        else if (time_limit.count() > 0 && nodes_searched_current % TIME_CHECK_INTERVAL == 0 &&
+                 std::chrono::steady_clock::now() - start_time >= time_limit)
+            search_aborted = true;
+        if (search_aborted)
+            return {0, NULL_MOVE, false};
+
+        if (current_state.isGameOver())
+        {
+            PlayerID winner = current_state.getWinner();
+            if (winner == my_player_id)
+                return {WIN_SCORE - current_ply_from_root, NULL_MOVE, false};
+            if (winner == PlayerID::DRAW || winner == PlayerID::NONE)
+                return {DRAW_SCORE, NULL_MOVE, false};
+            return {LOSS_SCORE + current_ply_from_root, NULL_MOVE, false};
+        }
+
+        // مسابقه خالص: نتیجه دقیق بدون گسترش درخت. RaceSolver از دید بازیکن نوبت‌دار امتیاز می‌دهد،
+        // پس اینجا بر اساس برنده و فاصله از ریشه به دید my_player_id تبدیل می‌شود.
+        if (std::optional<RaceSolver::RaceResult> race = RaceSolver::solve(current_state))
+        {
+            int plies_from_root = current_ply_from_root + race->plies_to_end;
+            int score = (race->winner == my_player_id) ? WIN_SCORE - plies_from_root : LOSS_SCORE + plies_from_root;
+            return {score, race->best_move, !(race->best_move == NULL_MOVE)};
+        }
+
+        if (depth <= 0)
+            return {Heuristics::evaluate(current_state, my_player_id), NULL_MOVE, false};
+
+        const int original_alpha = alpha;
+        const int original_beta = beta;
+        const uint64_t key = current_state.getZobristHash();
+        std::optional<TTEntry> tt_entry = transposition_table.probe(key);
+        if (tt_entry && tt_entry->depth >= depth && current_ply_from_root > 0)
+        {
+            int tt_score = scoreFromTT(tt_entry->score, current_ply_from_root);
+            if (tt_entry->type == TTEntryType::EXACT)
+                return {tt_score, tt_entry->best_move, true};
+            if (tt_entry->type == TTEntryType::LOWER_BOUND)
+                alpha = std::max(alpha, tt_score);
+            else
+                beta = std::min(beta, tt_score);
+            if (alpha >= beta)
+                return {tt_score, tt_entry->best_move, true};
+        }
+
+        std::vector<Move> moves = current_state.getLegalMoves();
+        if (moves.empty())
+            return {Heuristics::evaluate(current_state, my_player_id), NULL_MOVE, false};
+        orderMoves(moves, current_state, depth, tt_entry);
+
+        MinimaxResult best{maximizing_player ? INT_MIN : INT_MAX, NULL_MOVE, false};
+        for (const Move &move : moves)
+        {
+            GameState child = current_state.createChildState(move);
+            MinimaxResult child_result = minimaxAlphaBeta<NEXT_TO_MOVE>(child, depth - 1, alpha, beta,
+                                                                        start_time, time_limit, current_ply_from_root + 1);
+            if (search_aborted)
+                return {0, NULL_MOVE, false};
+
+            if (maximizing_player ? child_result.score > best.score : child_result.score < best.score)
+                best = {child_result.score, move, true};
+
+            if (maximizing_player)
+                alpha = std::max(alpha, best.score);
+            else
+                beta = std::min(beta, best.score);
+            if (alpha >= beta)
+                break;
+        }
+
+        TTEntryType type = TTEntryType::EXACT;
+        if (best.score <= original_alpha)
+            type = TTEntryType::UPPER_BOUND;
+        else if (best.score >= original_beta)
+            type = TTEntryType::LOWER_BOUND;
+        transposition_table.store(key, depth, scoreToTT(best.score, current_ply_from_root), type, best.best_move);
+        return best;
+    }
+
+    void AIPlayer::orderMoves(std::vector<Move> &moves, const GameState & /*state*/, int /*depth*/, const std::optional<TTEntry> &tt_entry)
+    {
+        // فعلاً فقط بهترین حرکت جدول انتقال به ابتدای فهرست منتقل می‌شود
+        if (!tt_entry || tt_entry->best_move == NULL_MOVE)
+            return;
+        auto it = std::find(moves.begin(), moves.end(), tt_entry->best_move);
+        if (it != moves.end())
+            std::rotate(moves.begin(), it, it + 1);
+    }
+
+} // namespace SquadroAI
@@ -0,0 +1,559 @@
+#include "DistributedSearch.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#include <httplib.h>
+
+#include "GameState.h"
+#include "Heuristics.h"
+
+namespace SquadroAI
+{
+
+    namespace RootSplitProtocol
+    {
+        namespace
+        {
+            class Writer
+            {
+            public:
+                template <typename T>
+                void put(T value)
+                {
+                    auto raw = static_cast<uint64_t>(value);
+                    for (size_t i = 0; i < sizeof(T); ++i)
+                        m_buffer.push_back(static_cast<char>((raw >> (8 * i)) & 0xFF));
+                }
+                std::string take() { return std::move(m_buffer); }
+
+            private:
+                std::string m_buffer;
+            };
+
+            class Reader
+            {
+            public:
+                explicit Reader(const std::string &buffer) : m_buffer(buffer) {}
+
+                template <typename T>
+                T get()
+                {
+                    if (m_pos + sizeof(T) > m_buffer.size())
+                        throw std::invalid_argument("Truncated root-split message");
+                    uint64_t raw = 0;
+                    for (size_t i = 0; i < sizeof(T); ++i)
+                        raw |= static_cast<uint64_t>(static_cast<unsigned char>(m_buffer[m_pos++])) << (8 * i);
+                    return static_cast<T>(raw);
+                }
+                bool atEnd() const { return m_pos == m_buffer.size(); }
+
+            private:
+                const std::string &m_buffer;
+                size_t m_pos = 0;
+            };
+
+            void putHeader(Writer &writer)
+            {
+                writer.put<uint32_t>(MAGIC);
+                writer.put<uint8_t>(VERSION);
+            }
+
+            void checkHeader(Reader &reader)
+            {
+                if (reader.get<uint32_t>() != MAGIC || reader.get<uint8_t>() != VERSION)
+                    throw std::invalid_argument("Bad root-split message header");
+            }
+
+            // حرکت تهی به صورت 0xFF ارسال می‌شود
+            void putMove(Writer &writer, const Move &move)
+            {
+                writer.put<uint8_t>(move.piece_index < 0 ? uint8_t{0xFF} : static_cast<uint8_t>(move.piece_index));
+            }
+
+            Move getMove(Reader &reader)
+            {
+                auto raw = reader.get<uint8_t>();
+                return Move(raw == 0xFF ? -1 : static_cast<int>(raw)); // Move برای اندیس نامعتبر استثنا پرتاب می‌کند
+            }
+
+            void putMoves(Writer &writer, const std::vector<Move> &moves)
+            {
+                if (moves.size() > UINT8_MAX)
+                    throw std::invalid_argument("Too many moves for root-split message");
+                writer.put<uint8_t>(static_cast<uint8_t>(moves.size()));
+                for (const Move &move : moves)
+                    putMove(writer, move);
+            }
+
+            std::vector<Move> getMoves(Reader &reader)
+            {
+                std::vector<Move> moves(reader.get<uint8_t>());
+                for (Move &move : moves)
+                    move = getMove(reader);
+                return moves;
+            }
+
+            // ورودی جدول انتقال: کلید (8) + حرکت (1) + امتیاز (4) + عمق (2) + نوع (1)
+            void putTTEntries(Writer &writer, const std::vector<TTEntry> &entries)
+            {
+                if (entries.size() > UINT16_MAX)
+                    throw std::invalid_argument("Too many TT entries for root-split message");
+                writer.put<uint16_t>(static_cast<uint16_t>(entries.size()));
+                for (const TTEntry &entry : entries)
+                {
+                    writer.put<uint64_t>(entry.zobrist_key_check);
+                    putMove(writer, entry.best_move);
+                    writer.put<uint32_t>(static_cast<uint32_t>(entry.score));
+                    writer.put<uint16_t>(static_cast<uint16_t>(entry.depth));
+                    writer.put<uint8_t>(static_cast<uint8_t>(entry.type));
+                }
+            }
+
+            std::vector<TTEntry> getTTEntries(Reader &reader)
+            {
+                std::vector<TTEntry> entries(reader.get<uint16_t>());
+                for (TTEntry &entry : entries)
+                {
+                    entry.zobrist_key_check = reader.get<uint64_t>();
+                    entry.best_move = getMove(reader);
+                    entry.score = static_cast<int32_t>(reader.get<uint32_t>());
+                    entry.depth = reader.get<uint16_t>();
+                    auto type = reader.get<uint8_t>();
+                    if (type > static_cast<uint8_t>(TTEntryType::UPPER_BOUND))
+                        throw std::invalid_argument("Bad TT entry type in root-split message");
+                    entry.type = static_cast<TTEntryType>(type);
+                    entry.is_valid = true;
+                }
+                return entries;
+            }
+        }
+
+        std::string encodeRequest(const WorkRequest &request)
+        {
+            if (request.move_history.size() > UINT16_MAX)
+                throw std::invalid_argument("Move history too long for root-split message");
+            Writer writer;
+            putHeader(writer);
+            writer.put<uint16_t>(static_cast<uint16_t>(request.move_history.size()));
+            for (const Move &move : request.move_history)
+                putMove(writer, move);
+            putMove(writer, request.root_move);
+            putMove(writer, request.reply_move);
+            writer.put<uint32_t>(request.time_limit_ms);
+            writer.put<uint16_t>(request.max_depth);
+            writer.put<uint8_t>(request.flags);
+            putTTEntries(writer, request.tt_entries);
+            return writer.take();
+        }
+
+        std::string encodeResult(const WorkResult &result)
+        {
+            Writer writer;
+            putHeader(writer);
+            putMove(writer, result.root_move);
+            writer.put<uint32_t>(static_cast<uint32_t>(result.score));
+            writer.put<uint16_t>(result.depth_reached);
+            writer.put<uint64_t>(result.nodes_searched);
+            putMoves(writer, result.principal_variation);
+            putTTEntries(writer, result.tt_entries);
+            return writer.take();
+        }
+
+        WorkRequest decodeRequest(const std::string &payload)
+        {
+            Reader reader(payload);
+            checkHeader(reader);
+            WorkRequest request;
+            auto history_size = reader.get<uint16_t>();
+            request.move_history.reserve(history_size);
+            for (uint16_t i = 0; i < history_size; ++i)
+                request.move_history.push_back(getMove(reader));
+            request.root_move = getMove(reader);
+            request.reply_move = getMove(reader);
+            request.time_limit_ms = reader.get<uint32_t>();
+            request.max_depth = reader.get<uint16_t>();
+            request.flags = reader.get<uint8_t>();
+            request.tt_entries = getTTEntries(reader);
+            if (!reader.atEnd())
+                throw std::invalid_argument("Trailing bytes in root-split request");
+            return request;
+        }
+
+        WorkResult decodeResult(const std::string &payload)
+        {
+            Reader reader(payload);
+            checkHeader(reader);
+            WorkResult result;
+            result.root_move = getMove(reader);
+            result.score = static_cast<int32_t>(reader.get<uint32_t>());
+            result.depth_reached = reader.get<uint16_t>();
+            result.nodes_searched = reader.get<uint64_t>();
+            result.principal_variation = getMoves(reader);
+            result.tt_entries = getTTEntries(reader);
+            if (!reader.atEnd())
+                throw std::invalid_argument("Trailing bytes in root-split result");
+            return result;
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // SearchWorkerServer
+
+    SearchWorkerServer::SearchWorkerServer(size_t tt_size_mb)
+        : m_server(std::make_unique<httplib::Server>()),
+          m_player1_ai(PlayerID::PLAYER_1, tt_size_mb),
+          m_player2_ai(PlayerID::PLAYER_2, tt_size_mb)
+    {
+        m_server->Post(RootSplitProtocol::SEARCH_PATH, [this](const httplib::Request &req, httplib::Response &res)
+                       {
+            try
+            {
+                RootSplitProtocol::WorkResult result = handle(RootSplitProtocol::decodeRequest(req.body));
+                res.set_content(RootSplitProtocol::encodeResult(result), "application/octet-stream");
+            }
+            catch (const std::exception &e)
+            {
+                res.status = 400;
+                res.set_content(e.what(), "text/plain");
+            } });
+    }
+
+    SearchWorkerServer::~SearchWorkerServer()
+    {
+        stop();
+    }
+
+    bool SearchWorkerServer::listen(const std::string &ip, int port)
+    {
+        return m_server->listen(ip, port);
+    }
+
+    void SearchWorkerServer::stop()
+    {
+        if (m_server && m_server->is_running())
+            m_server->stop();
+    }
+
+    RootSplitProtocol::WorkResult SearchWorkerServer::handle(const RootSplitProtocol::WorkRequest &request)
+    {
+        // بودجه زمانی از لحظه دریافت درخواست حساب می‌شود تا بازسازی وضعیت و پاک کردن جدول هم در آن باشد
+        auto received = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(m_search_mutex);
+        // پرچم پاک کردن باید پیش از هر بازگشت زودهنگام اعمال شود، وگرنه کار بعدی با جدول وضعیت قبلی جستجو می‌کند
+        if (request.flags & RootSplitProtocol::FLAG_CLEAR_TT)
+        {
+            m_player1_ai.resetSearchState();
+            m_player2_ai.resetSearchState();
+        }
+
+        GameState state;
+        state.initializeNewGame();
+        for (const Move &move : request.move_history)
+        {
+            if (!state.applyMove(move))
+                throw std::invalid_argument("Illegal move in root-split history: " + move.to_string());
+        }
+        PlayerID root_player = state.getCurrentPlayer();
+
+        RootSplitProtocol::WorkResult result;
+        result.root_move = request.root_move;
+        std::vector<Move> prefix{request.root_move};
+        if (!(request.reply_move == NULL_MOVE))
+            prefix.push_back(request.reply_move);
+        for (const Move &move : prefix)
+        {
+            if (state.isGameOver() || !state.applyMove(move))
+                throw std::invalid_argument("Illegal root-split move: " + move.to_string());
+            result.principal_variation.push_back(move);
+        }
+        if (state.isGameOver())
+        {
+            PlayerID winner = state.getWinner();
+            int ply = static_cast<int>(prefix.size());
+            result.score = (winner == root_player) ? WIN_SCORE - ply : (winner == PlayerID::DRAW ? DRAW_SCORE : LOSS_SCORE + ply);
+            return result;
+        }
+
+        if (request.max_depth == 0)
+        {
+            result.score = Heuristics::evaluate(state, root_player);
+            return result;
+        }
+
+        AIPlayer &ai = (state.getCurrentPlayer() == PlayerID::PLAYER_1) ? m_player1_ai : m_player2_ai;
+        ai.importEntries(request.tt_entries);
+
+        SearchLimits limits;
+        limits.max_depth = (request.max_depth == RootSplitProtocol::NO_DEPTH_LIMIT) ? 0 : request.max_depth;
+        if (request.time_limit_ms > 0) // 0 = بدون محدودیت زمانی
+        {
+            auto spent = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - received);
+            limits.time_limit = std::max(std::chrono::milliseconds(1), std::chrono::milliseconds(request.time_limit_ms) - spent);
+        }
+        else
+        {
+            limits.time_limit = std::chrono::milliseconds(0);
+        }
+        SearchReport report = ai.analyzePosition(state, limits);
+        // امتیاز گزارش شده از دید بازیکن نوبت‌دار وضعیت جستجوشده است؛ اگر او بازیکن ریشه نباشد برعکس می‌شود
+        // امتیاز قطعی نسبت به وضعیت جستجوشده است و به اندازه طول prefix از ریشه دورتر است
+        int score = (state.getCurrentPlayer() == root_player) ? report.score : -report.score;
+        int ply = static_cast<int>(prefix.size());
+        if (score >= WIN_SCORE - DECISIVE_SCORE_MARGIN)
+            score -= ply;
+        else if (score <= LOSS_SCORE + DECISIVE_SCORE_MARGIN)
+            score += ply;
+        result.score = score;
+        result.depth_reached = static_cast<uint16_t>(report.depth_reached + static_cast<int>(prefix.size()));
+        result.nodes_searched = static_cast<uint64_t>(report.nodes_searched);
+        result.principal_variation.insert(result.principal_variation.end(),
+                                          report.principal_variation.begin(), report.principal_variation.end());
+        result.tt_entries = ai.exportDeepEntries(RootSplitProtocol::TT_EXCHANGE_MIN_DEPTH, RootSplitProtocol::TT_EXCHANGE_MAX_ENTRIES);
+        return result;
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // RootSplitCoordinator
+
+    namespace
+    {
+        // زمانی که پیش از مهلت برای رفت‌وبرگشت شبکه، استخراج PV و خروجی جدول کنار گذاشته می‌شود
+        constexpr std::chrono::milliseconds MAX_REPLY_MARGIN(50);
+
+        std::chrono::milliseconds replyMargin(std::chrono::milliseconds remaining)
+        {
+            return std::min(MAX_REPLY_MARGIN, remaining / 4);
+        }
+
+        std::vector<TTEntry> deepestEntries(const std::unordered_map<uint64_t, TTEntry> &shared_tt)
+        {
+            std::vector<TTEntry> entries;
+            entries.reserve(shared_tt.size());
+            for (const auto &item : shared_tt)
+                entries.push_back(item.second);
+            size_t count = std::min(entries.size(), RootSplitProtocol::TT_EXCHANGE_MAX_ENTRIES);
+            std::partial_sort(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(count), entries.end(),
+                              [](const TTEntry &a, const TTEntry &b)
+                              { return a.depth > b.depth; });
+            entries.resize(count);
+            return entries;
+        }
+    }
+
+    RootSplitCoordinator::RootSplitCoordinator(std::vector<WorkerEndpoint> workers) : m_workers(std::move(workers))
+    {
+        if (m_workers.empty())
+            throw std::invalid_argument("RootSplitCoordinator requires at least one worker");
+    }
+
+    SearchReport RootSplitCoordinator::findBestMove(const GameState &state, std::chrono::milliseconds time_limit, int max_depth)
+    {
+        return findBestMove(state.getMoveHistory(), time_limit, max_depth);
+    }
+
+    SearchReport RootSplitCoordinator::findBestMove(const std::vector<Move> &move_history,
+                                                    std::chrono::milliseconds time_limit, int max_depth)
+    {
+        auto deadline = std::chrono::steady_clock::now() + time_limit;
+
+        GameState root_state;
+        root_state.initializeNewGame();
+        for (const Move &move : move_history)
+        {
+            if (!root_state.applyMove(move))
+                throw std::invalid_argument("Illegal move in history: " + move.to_string());
+        }
+
+        SearchReport report;
+        std::vector<Move> root_moves = root_state.getLegalMoves();
+        if (root_moves.empty())
+            return report;
+
+        // اگر workerها از حرکات ریشه بیشتر باشند هر پاسخ حریف یک کار جداست (فقط وقتی عمق حداقل 2 مجاز باشد)
+        struct Job
+        {
+            size_t root_index;
+            Move reply_move;
+        };
+        std::vector<Job> jobs;
+        bool split_replies = m_workers.size() > root_moves.size() && (max_depth == 0 || max_depth >= 2);
+        for (size_t i = 0; i < root_moves.size(); ++i)
+        {
+            GameState child = root_state.createChildState(root_moves[i]);
+            std::vector<Move> replies = (split_replies && !child.isGameOver()) ? child.getLegalMoves() : std::vector<Move>();
+            if (replies.empty())
+                jobs.push_back({i, NULL_MOVE}); // worker خود پایان بازی را تشخیص می‌دهد
+            for (const Move &reply : replies)
+                jobs.push_back({i, reply});
+        }
+
+        // هر worker به اندازه سهم خود از کارها زمان می‌گیرد
+        size_t rounds = (jobs.size() + m_workers.size() - 1) / m_workers.size();
+        std::chrono::milliseconds per_job_budget = time_limit / static_cast<long long>(rounds);
+        int split_plies = split_replies ? 2 : 1;
+        uint16_t job_depth = (max_depth > 0) ? static_cast<uint16_t>(max_depth - split_plies) : RootSplitProtocol::NO_DEPTH_LIMIT;
+
+        std::vector<RootSplitProtocol::WorkResult> results(jobs.size());
+        std::vector<char> completed(jobs.size(), 0);
+        std::deque<size_t> pending_jobs;
+        for (size_t job = 0; job < jobs.size(); ++job)
+            pending_jobs.push_back(job);
+        size_t jobs_in_flight = 0;
+        size_t live_workers = m_workers.size();
+        std::unordered_map<uint64_t, TTEntry> shared_tt; // عمیق‌ترین ورودی دریافتی برای هر کلید
+        std::mutex queue_mutex; // از pending_jobs، شمارنده‌ها، results، completed و shared_tt محافظت می‌کند
+        std::condition_variable queue_changed;
+
+        auto worker_loop = [&](const WorkerEndpoint &endpoint)
+        {
+            httplib::Client client(endpoint.host, endpoint.port);
+            bool first_request = true;
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            while (true)
+            {
+                // منتظر کار جدید یا برگشت کار یک worker ازکارافتاده؛ اگر صف خالی و کاری در جریان نباشد جستجو تمام است
+                if (!queue_changed.wait_until(lock, deadline, [&]
+                                              { return !pending_jobs.empty() || jobs_in_flight == 0; }) ||
+                    pending_jobs.empty() || std::chrono::steady_clock::now() >= deadline)
+                    return;
+                size_t job = pending_jobs.front();
+                pending_jobs.pop_front();
+                ++jobs_in_flight;
+                std::vector<TTEntry> tt_snapshot = deepestEntries(shared_tt);
+                lock.unlock();
+
+                std::chrono::milliseconds remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+                std::chrono::milliseconds job_budget = std::min(remaining - replyMargin(remaining), per_job_budget);
+                if (job_budget.count() <= 0)
+                {
+                    // زمان کافی برای یک پاسخ به‌موقع نمانده است
+                    lock.lock();
+                    --jobs_in_flight;
+                    pending_jobs.push_front(job);
+                    queue_changed.notify_all();
+                    return;
+                }
+
+                RootSplitProtocol::WorkRequest request;
+                request.move_history = move_history;
+                request.root_move = root_moves[jobs[job].root_index];
+                request.reply_move = jobs[job].reply_move;
+                request.time_limit_ms = static_cast<uint32_t>(job_budget.count());
+                request.max_depth = job_depth;
+                request.flags = first_request ? RootSplitProtocol::FLAG_CLEAR_TT : 0;
+                request.tt_entries = std::move(tt_snapshot);
+
+                // کمی حاشیه برای رفت‌وبرگشت شبکه
+                client.set_read_timeout(remaining + std::chrono::milliseconds(200));
+                auto res = client.Post(RootSplitProtocol::SEARCH_PATH, RootSplitProtocol::encodeRequest(request),
+                                       "application/octet-stream");
+                std::optional<RootSplitProtocol::WorkResult> result;
+                if (res && res->status == 200)
+                {
+                    try
+                    {
+                        result = RootSplitProtocol::decodeResult(res->body);
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::cerr << "[RootSplit] Bad reply from " << endpoint.host << ":" << endpoint.port
+                                  << ": " << e.what() << std::endl;
+                    }
+                }
+
+                lock.lock();
+                --jobs_in_flight;
+                if (!result)
+                {
+                    // کار به صف برمی‌گردد تا workerهای سالم آن را بردارند و این worker دیگر استفاده نمی‌شود
+                    std::cerr << "[RootSplit] Worker " << endpoint.host << ":" << endpoint.port << " failed on "
+                              << request.root_move.to_string()
+                              << (request.reply_move == NULL_MOVE ? std::string() : " " + request.reply_move.to_string())
+                              << "; requeueing and dropping this worker." << std::endl;
+                    pending_jobs.push_front(job);
+                    --live_workers;
+                    queue_changed.notify_all();
+                    return;
+                }
+                first_request = false;
+                for (const TTEntry &entry : result->tt_entries)
+                {
+                    auto it = shared_tt.find(entry.zobrist_key_check);
+                    if (it == shared_tt.end() || it->second.depth < entry.depth)
+                        shared_tt[entry.zobrist_key_check] = entry;
+                }
+                if (std::chrono::steady_clock::now() <= deadline)
+                {
+                    results[job] = *result;
+                    completed[job] = 1;
+                }
+                queue_changed.notify_all();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(m_workers.size());
+        for (const WorkerEndpoint &endpoint : m_workers)
+            threads.emplace_back(worker_loop, std::cref(endpoint));
+        for (auto &thread : threads)
+            thread.join();
+
+        if (live_workers == 0 && !pending_jobs.empty())
+            throw std::runtime_error("All root-split workers failed before every root move was searched");
+
+        // امتیاز هر حرکت ریشه کمینه امتیاز پاسخ‌های آن است (حریف بهترین پاسخ را انتخاب می‌کند)؛
+        // حرکت ریشه فقط وقتی معتبر است که همه کارهایش کامل شده باشند
+        std::vector<char> root_searched(root_moves.size(), 1);
+        std::vector<size_t> root_best_job(root_moves.size(), jobs.size());
+        for (size_t job = 0; job < jobs.size(); ++job)
+        {
+            size_t root = jobs[job].root_index;
+            if (!completed[job])
+            {
+                root_searched[root] = 0;
+                continue;
+            }
+            report.nodes_searched += static_cast<long long>(results[job].nodes_searched);
+            if (root_best_job[root] == jobs.size() || results[job].score < results[root_best_job[root]].score)
+                root_best_job[root] = job;
+        }
+
+        size_t unsearched = static_cast<size_t>(std::count(root_searched.begin(), root_searched.end(), 0));
+        if (unsearched == root_moves.size())
+            throw std::runtime_error("No root move was searched before the root-split deadline");
+        if (unsearched > 0)
+            std::cerr << "[RootSplit] Deadline reached with " << unsearched << " of " << root_moves.size()
+                      << " root moves unsearched." << std::endl;
+
+        int best_score = INT_MIN;
+        for (size_t i = 0; i < root_moves.size(); ++i)
+        {
+            if (!root_searched[i])
+                continue;
+            const RootSplitProtocol::WorkResult &result = results[root_best_job[i]];
+            if (result.score > best_score)
+            {
+                best_score = result.score;
+                report.best_move = result.root_move;
+                report.score = result.score;
+                report.principal_variation = result.principal_variation;
+                // عمق کامل‌شده یک حرکت ریشه، کم‌عمق‌ترین جستجوی پاسخ‌های آن است
+                report.depth_reached = INT_MAX;
+                for (size_t job = 0; job < jobs.size(); ++job)
+                {
+                    if (jobs[job].root_index == i)
+                        report.depth_reached = std::min(report.depth_reached, static_cast<int>(results[job].depth_reached));
+                }
+            }
+        }
+        return report;
+    }
+
+} // namespace SquadroAI
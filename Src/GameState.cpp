@@ -0,0 +1,41 @@
+#include "GameState.h"
+
+namespace SquadroAI
+{
+
+    namespace
+    {
+        // آیا مهره برای همیشه از خانه‌ای با مختصات lane_pos در مسیرش عبور کرده است؟
+        // فقط در مسیر برگشت (یا پس از پایان) عبور قطعی است؛ در مسیر رفت مهره دوباره از همان خانه برمی‌گردد.
+        template <PlayerID P>
+        bool hasPassedForGood(const Piece &piece, int lane_pos)
+        {
+            if (piece.status == PieceStatus::FINISHED)
+                return true;
+            return piece.status == PieceStatus::ON_BOARD_BACKWARD && piece.laneProgress<P>() < lane_pos;
+        }
+    }
+
+    bool GameState::isPureRace() const
+    {
+        // مهره i بازیکن 1 روی سطر i+1 و مهره j بازیکن 2 روی ستون j+1 حرکت می‌کند،
+        // پس تنها نقطه برخورد ممکن این دو، خانه (i+1, j+1) است.
+        for (const Piece &p1_piece : pieces)
+        {
+            if (p1_piece.owner != PlayerID::PLAYER_1)
+                continue;
+            for (const Piece &p2_piece : pieces)
+            {
+                if (p2_piece.owner != PlayerID::PLAYER_2)
+                    continue;
+                int crossing_row = p1_piece.player_piece_index + 1;
+                int crossing_col = p2_piece.player_piece_index + 1;
+                if (!hasPassedForGood<PlayerID::PLAYER_1>(p1_piece, crossing_col) &&
+                    !hasPassedForGood<PlayerID::PLAYER_2>(p2_piece, crossing_row))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace SquadroAI
@@ -0,0 +1,94 @@
+#include "RaceSolver.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "GameState.h"
+
+namespace SquadroAI
+{
+
+    template <PlayerID P>
+    int RaceSolver::remainingMovesFor(const Piece &piece)
+    {
+        auto forward = static_cast<size_t>(piece.forward_power);
+        auto backward = static_cast<size_t>(piece.backward_power);
+
+        switch (piece.status)
+        {
+        case PieceStatus::FINISHED:
+            return 0;
+        case PieceStatus::ON_BOARD_BACKWARD:
+            return STEPS[backward][static_cast<size_t>(piece.laneProgress<P>())];
+        case PieceStatus::ON_BOARD_FORWARD:
+        case PieceStatus::NOT_STARTED:
+            break;
+        }
+        return STEPS[forward][static_cast<size_t>(LANE_LENGTH - piece.laneProgress<P>())] + STEPS[backward][LANE_LENGTH];
+    }
+
+    int RaceSolver::remainingMoves(const Piece &piece)
+    {
+        return (piece.owner == PlayerID::PLAYER_1) ? remainingMovesFor<PlayerID::PLAYER_1>(piece)
+                                                   : remainingMovesFor<PlayerID::PLAYER_2>(piece);
+    }
+
+    template <PlayerID ToMove>
+    RaceSolver::RaceResult RaceSolver::solveFor(const GameState &state)
+    {
+        constexpr PlayerID Opponent = PlayerTraits<ToMove>::OPPONENT;
+
+        // حرکات باقی‌مانده هر مهره، به ترتیب صعودی
+        std::vector<std::pair<int, int>> my_costs; // (حرکات باقی‌مانده, player_piece_index)
+        std::vector<int> opponent_costs;
+        for (const Piece &piece : state.getPieces())
+        {
+            if (piece.owner == ToMove)
+                my_costs.emplace_back(remainingMovesFor<ToMove>(piece), piece.player_piece_index);
+            else if (piece.owner == Opponent)
+                opponent_costs.push_back(remainingMovesFor<Opponent>(piece));
+        }
+        if (my_costs.size() < static_cast<size_t>(PIECES_TO_WIN) || opponent_costs.size() < static_cast<size_t>(PIECES_TO_WIN))
+            throw std::logic_error("RaceSolver: not enough pieces in GameState");
+        std::sort(my_costs.begin(), my_costs.end());
+        std::sort(opponent_costs.begin(), opponent_costs.end());
+
+        int my_turns = 0;
+        int opponent_turns = 0;
+        for (size_t i = 0; i < static_cast<size_t>(PIECES_TO_WIN); ++i)
+        {
+            my_turns += my_costs[i].first;
+            opponent_turns += opponent_costs[i];
+        }
+
+        RaceResult result;
+        // بازیکنی که نوبت اوست اول حرکت می‌کند، پس با تعداد نوبت برابر برنده است
+        bool to_move_wins = my_turns <= opponent_turns;
+        result.winner = to_move_wins ? ToMove : Opponent;
+        result.plies_to_end = to_move_wins ? 2 * my_turns - 1 : 2 * opponent_turns;
+        result.score = to_move_wins ? WIN_SCORE - result.plies_to_end : LOSS_SCORE + result.plies_to_end;
+
+        // هر مهره ناتمام از میان سریع‌ترین PIECES_TO_WIN مهره، نیاز را دقیقاً یک نوبت کم می‌کند
+        result.best_move = NULL_MOVE;
+        for (size_t i = 0; i < static_cast<size_t>(PIECES_TO_WIN); ++i)
+        {
+            if (my_costs[i].first > 0)
+            {
+                result.best_move = Move(my_costs[i].second);
+                break;
+            }
+        }
+        return result;
+    }
+
+    std::optional<RaceSolver::RaceResult> RaceSolver::solve(const GameState &state)
+    {
+        if (state.isGameOver() || !state.isPureRace())
+            return std::nullopt;
+
+        if (state.getCurrentPlayer() == PlayerID::PLAYER_1)
+            return solveFor<PlayerID::PLAYER_1>(state);
+        return solveFor<PlayerID::PLAYER_2>(state);
+    }
+
+} // namespace SquadroAI
@@ -0,0 +1,92 @@
+#include "TranspositionTable.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace SquadroAI
+{
+
+    TranspositionTable::TranspositionTable(size_t size_mb)
+    {
+        num_entries = (size_mb * 1024 * 1024) / sizeof(TTEntry);
+        if (num_entries == 0)
+            num_entries = 1;
+        table.resize(num_entries);
+    }
+
+    size_t TranspositionTable::getIndex(uint64_t zobrist_key) const
+    {
+        return static_cast<size_t>(zobrist_key % num_entries);
+    }
+
+    void TranspositionTable::store(uint64_t zobrist_key, int depth, int score, TTEntryType type, const Move &best_move)
+    {
+        TTEntry &entry = table[getIndex(zobrist_key)];
+        // جایگزینی بر اساس عمق: ورودی عمیق‌تر همان وضعیت با ورودی کم‌عمق‌تر بازنویسی نمی‌شود
+        if (isLive(entry) && entry.zobrist_key_check == zobrist_key && entry.depth > depth)
+            return;
+
+        entry.zobrist_key_check = zobrist_key;
+        entry.depth = depth;
+        entry.score = score;
+        entry.type = type;
+        entry.best_move = best_move;
+        entry.is_valid = true;
+        entry.generation = current_generation;
+
+        if (depth >= DEEP_KEY_MIN_DEPTH)
+        {
+            if (deep_keys.size() < DEEP_KEY_CAPACITY)
+                deep_keys.push_back(zobrist_key);
+            else
+                deep_keys[deep_keys_next] = zobrist_key;
+            deep_keys_next = (deep_keys_next + 1) % DEEP_KEY_CAPACITY;
+        }
+    }
+
+    std::optional<TTEntry> TranspositionTable::probe(uint64_t zobrist_key) const
+    {
+        const TTEntry &entry = table[getIndex(zobrist_key)];
+        if (isLive(entry) && entry.zobrist_key_check == zobrist_key)
+            return entry;
+        return std::nullopt;
+    }
+
+    std::vector<TTEntry> TranspositionTable::collectDeepEntries(int min_depth, size_t max_count) const
+    {
+        std::vector<TTEntry> entries;
+        std::unordered_set<uint64_t> seen;
+        for (uint64_t key : deep_keys)
+        {
+            // ممکن است ورودی از آن زمان بازنویسی شده باشد؛ فقط ورودی زنده همان کلید پذیرفته می‌شود
+            std::optional<TTEntry> entry = probe(key);
+            if (entry && entry->depth >= min_depth && seen.insert(key).second)
+                entries.push_back(*entry);
+        }
+        auto deeper = [](const TTEntry &a, const TTEntry &b)
+        { return a.depth > b.depth; };
+        if (entries.size() > max_count)
+        {
+            std::partial_sort(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(max_count), entries.end(), deeper);
+            entries.resize(max_count);
+        }
+        else
+        {
+            std::sort(entries.begin(), entries.end(), deeper);
+        }
+        return entries;
+    }
+
+    void TranspositionTable::clear()
+    {
+        // در حالت عادی پاک کردن فقط نسل را عوض می‌کند؛ پر کردن کامل جدول فقط هنگام سرریز شمارنده لازم است
+        if (++current_generation == 0)
+        {
+            std::fill(table.begin(), table.end(), TTEntry());
+            current_generation = 1;
+        }
+        deep_keys.clear();
+        deep_keys_next = 0;
+    }
+
+} // namespace SquadroAI
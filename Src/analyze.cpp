@@ -0,0 +1,329 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+
+#include <nlohmann/json.hpp>
+
+#include "Constants.h"
+#include "Move.h"
+#include "GameState.h"
+#include "AIPlayer.h"
+
+// Batch position analysis.
+//
+// Every non-empty input line describes one position as the sequence of moves
+// (player-relative pawn indices 0-4, Player 1 first) that leads to it from the
+// initial position, optionally followed by per-position limit overrides:
+//
+//     0 3 2 4 1 ; depth=10 nodes=200000 time_ms=500
+//
+// A limit of 0 disables it, e.g. "time_ms=0 depth=8" is a purely depth-limited search
+// whose result does not depend on machine load or thread count.
+//
+// Lines starting with '#' are ignored. Positions are distributed over a pool of
+// worker threads, each owning its own AIPlayer instances (and therefore its own
+// transposition tables), so no search state is shared between threads.
+// Transposition tables are cleared before every position so each result depends
+// only on its own line; --keep-tt opts into reusing them for speed instead.
+// Results are written to stdout as JSONL in input order.
+
+using namespace SquadroAI;
+using json = nlohmann::json;
+
+namespace
+{
+    struct PositionTask
+    {
+        size_t index;
+        std::string line;
+    };
+
+    struct AnalyzerOptions
+    {
+        std::string input_path;
+        unsigned int num_threads = 0; // 0 = std::thread::hardware_concurrency()
+        size_t tt_size_mb = 16;       // per AIPlayer instance
+        bool keep_tt = false;         // reuse transposition tables across positions (non-deterministic output)
+        SearchLimits default_limits;
+    };
+
+    // Reads positions from the input file on demand. Together with OrderedWriter's reorder window this keeps
+    // memory bounded by the window size rather than the input size.
+    class PositionReader
+    {
+    public:
+        explicit PositionReader(std::istream &input) : m_input(input) {}
+
+        bool next(PositionTask &task)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::string line;
+            while (std::getline(m_input, line))
+            {
+                size_t first = line.find_first_not_of(" \t\r");
+                if (first == std::string::npos || line[first] == '#')
+                    continue;
+                task.index = m_next_index++;
+                task.line = line;
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        std::istream &m_input;
+        std::mutex m_mutex;
+        size_t m_next_index = 0;
+    };
+
+    // Buffers out-of-order results and flushes them to the stream strictly in input order.
+    // Workers must call waitForSlot() before analyzing a position so at most `window` positions
+    // can run ahead of the oldest unwritten one.
+    class OrderedWriter
+    {
+    public:
+        OrderedWriter(std::ostream &output, size_t window) : m_output(output), m_window(window) {}
+
+        void waitForSlot(size_t index)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // The position at m_next_index is always admitted, so the writer can never stall on itself.
+            m_slot_freed.wait(lock, [&]
+                              { return index < m_next_index + m_window; });
+        }
+
+        void submit(size_t index, std::string result)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_pending.emplace(index, std::move(result));
+            auto it = m_pending.begin();
+            while (it != m_pending.end() && it->first == m_next_index)
+            {
+                m_output << it->second << '\n';
+                it = m_pending.erase(it);
+                ++m_next_index;
+            }
+            m_output.flush();
+            lock.unlock();
+            m_slot_freed.notify_all();
+        }
+
+    private:
+        std::ostream &m_output;
+        size_t m_window;
+        std::mutex m_mutex;
+        std::condition_variable m_slot_freed;
+        std::map<size_t, std::string> m_pending;
+        size_t m_next_index = 0;
+    };
+
+    // Parses "<moves> [; key=value ...]" into a move list and the effective limits.
+    void parsePositionLine(const std::string &line, const SearchLimits &defaults,
+                           std::vector<Move> &moves, SearchLimits &limits)
+    {
+        limits = defaults;
+        size_t separator = line.find(';');
+
+        std::istringstream move_stream(line.substr(0, separator));
+        std::string token;
+        while (move_stream >> token)
+        {
+            moves.push_back(Move(std::stoi(token))); // Move throws std::invalid_argument for bad indices
+        }
+
+        std::istringstream option_stream(separator == std::string::npos ? std::string() : line.substr(separator + 1));
+        while (option_stream >> token)
+        {
+            size_t eq = token.find('=');
+            if (eq == std::string::npos)
+                throw std::invalid_argument("Malformed limit override: " + token);
+            std::string key = token.substr(0, eq);
+            std::string value = token.substr(eq + 1);
+            if (key == "depth")
+                limits.max_depth = std::stoi(value);
+            else if (key == "nodes")
+                limits.max_nodes = std::stoll(value);
+            else if (key == "time_ms")
+                limits.time_limit = std::chrono::milliseconds(std::stoll(value));
+            else
+                throw std::invalid_argument("Unknown limit override: " + key);
+        }
+        if (limits.time_limit.count() <= 0 && limits.max_depth <= 0 && limits.max_nodes <= 0)
+            throw std::invalid_argument("At least one of depth, nodes or time_ms must be limited");
+    }
+
+    json analyzeTask(const PositionTask &task, const AnalyzerOptions &options,
+                     AIPlayer &player1_ai, AIPlayer &player2_ai)
+    {
+        json result;
+        result["index"] = task.index;
+
+        std::vector<Move> moves;
+        SearchLimits limits;
+        try
+        {
+            parsePositionLine(task.line, options.default_limits, moves, limits);
+        }
+        catch (const std::exception &e)
+        {
+            result["error"] = std::string("parse error: ") + e.what();
+            return result;
+        }
+
+        GameState state;
+        state.initializeNewGame();
+        for (size_t ply = 0; ply < moves.size(); ++ply)
+        {
+            if (state.isGameOver() || !state.applyMove(moves[ply]))
+            {
+                result["error"] = "illegal move " + moves[ply].to_string() + " at ply " + std::to_string(ply);
+                return result;
+            }
+        }
+
+        result["ply"] = moves.size();
+        result["side_to_move"] = static_cast<int>(state.getCurrentPlayer());
+        if (state.isGameOver())
+        {
+            result["game_over"] = true;
+            result["winner"] = static_cast<int>(state.getWinner());
+            return result;
+        }
+
+        AIPlayer &ai = (state.getCurrentPlayer() == PlayerID::PLAYER_1) ? player1_ai : player2_ai;
+        if (!options.keep_tt)
+            ai.resetSearchState();
+        auto start = std::chrono::steady_clock::now();
+        SearchReport report = ai.analyzePosition(state, limits);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        result["best_move"] = report.best_move.piece_index;
+        result["score"] = report.score;
+        result["depth"] = report.depth_reached;
+        result["nodes"] = report.nodes_searched;
+        result["time_ms"] = elapsed.count();
+        return result;
+    }
+
+    void workerLoop(PositionReader &reader, OrderedWriter &writer, const AnalyzerOptions &options,
+                    std::atomic<size_t> &positions_done)
+    {
+        // Each worker owns one AIPlayer per side; search state is never shared across threads.
+        AIPlayer player1_ai(PlayerID::PLAYER_1, options.tt_size_mb);
+        AIPlayer player2_ai(PlayerID::PLAYER_2, options.tt_size_mb);
+
+        PositionTask task;
+        while (reader.next(task))
+        {
+            writer.waitForSlot(task.index);
+            json result;
+            try
+            {
+                result = analyzeTask(task, options, player1_ai, player2_ai);
+            }
+            catch (const std::exception &e)
+            {
+                result = json{{"index", task.index}, {"error", e.what()}};
+            }
+            writer.submit(task.index, result.dump());
+            positions_done.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void printUsage(const char *program_name)
+    {
+        std::cerr << "Usage: " << program_name
+                  << " <positions_file> [--threads N] [--time-ms T] [--depth D] [--nodes N] [--tt-mb M] [--keep-tt]" << std::endl;
+        std::cerr << "Each line of positions_file is a move sequence from the initial position, e.g. \"0 3 2 4\","
+                  << " optionally followed by \"; depth=D nodes=N time_ms=T\"." << std::endl;
+        std::cerr << "A limit of 0 means unlimited (default: --time-ms 1000, no depth or node limit)." << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    AnalyzerOptions options;
+    options.input_path = argv[1];
+    try
+    {
+        for (int i = 2; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "--keep-tt")
+            {
+                options.keep_tt = true;
+                continue;
+            }
+            if (i + 1 >= argc)
+                throw std::invalid_argument("Missing value for " + arg);
+            std::string value = argv[++i];
+            if (arg == "--threads")
+                options.num_threads = static_cast<unsigned int>(std::stoul(value));
+            else if (arg == "--time-ms")
+                options.default_limits.time_limit = std::chrono::milliseconds(std::stoll(value));
+            else if (arg == "--depth")
+                options.default_limits.max_depth = std::stoi(value);
+            else if (arg == "--nodes")
+                options.default_limits.max_nodes = std::stoll(value);
+            else if (arg == "--tt-mb")
+                options.tt_size_mb = std::stoul(value);
+            else
+                throw std::invalid_argument("Unknown option " + arg);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (options.num_threads == 0)
+        options.num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::ifstream input(options.input_path);
+    if (!input)
+    {
+        std::cerr << "Error: Cannot open positions file: " << options.input_path << std::endl;
+        return 1;
+    }
+
+    PositionReader reader(input);
+    // At most a few positions per thread may finish ahead of the oldest unwritten one.
+    OrderedWriter writer(std::cout, 4 * static_cast<size_t>(options.num_threads));
+    std::atomic<size_t> positions_done{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(options.num_threads);
+    for (unsigned int t = 0; t < options.num_threads; ++t)
+    {
+        workers.emplace_back(workerLoop, std::ref(reader), std::ref(writer), std::cref(options), std::ref(positions_done));
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t total = positions_done.load();
+    std::cerr << "Analyzed " << total << " positions in " << seconds << " s using " << options.num_threads
+              << " threads (" << (seconds > 0.0 ? static_cast<double>(total) / seconds : 0.0) << " positions/s)." << std::endl;
+    return 0;
+}
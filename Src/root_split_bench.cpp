@@ -0,0 +1,115 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <chrono>
+
+#include "Constants.h"
+#include "Move.h"
+#include "GameState.h"
+#include "AIPlayer.h"
+#include "DistributedSearch.h"
+
+// Compares the single-process search against RootSplitCoordinator on a fixed set of positions.
+// Both searches run to the same fixed depth, so the wall-clock ratio is the speedup.
+// Both sides start every position with empty transposition tables: the local AIPlayers are reset and
+// the coordinator asks each worker to clear its tables on its first request for the position.
+//
+// Example with three local workers on loopback:
+//     SquadroAI_Worker 127.0.0.1 7001 &
+//     SquadroAI_Worker 127.0.0.1 7002 &
+//     SquadroAI_Worker 127.0.0.1 7003 &
+//     SquadroAI_RootSplitBench 10 127.0.0.1:7001 127.0.0.1:7002 127.0.0.1:7003
+
+using namespace SquadroAI;
+
+namespace
+{
+    // Positions as move sequences from the initial position (player-relative pawn indices).
+    const std::vector<std::vector<int>> BENCH_POSITIONS = {
+        {},
+        {2, 2},
+        {0, 4, 1, 3},
+        {2, 1, 3, 0, 4, 2},
+        {1, 1, 3, 3, 2, 0, 4, 4},
+    };
+
+    WorkerEndpoint parseEndpoint(const std::string &text)
+    {
+        size_t colon = text.rfind(':');
+        if (colon == std::string::npos)
+            throw std::invalid_argument("Expected host:port, got " + text);
+        return WorkerEndpoint{text.substr(0, colon), std::stoi(text.substr(colon + 1))};
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <depth> <host:port> [host:port ...]" << std::endl;
+        return 1;
+    }
+
+    int depth;
+    std::vector<WorkerEndpoint> workers;
+    try
+    {
+        depth = std::stoi(argv[1]);
+        for (int i = 2; i < argc; ++i)
+            workers.push_back(parseEndpoint(argv[i]));
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: Invalid argument. " << e.what() << std::endl;
+        return 1;
+    }
+
+    // مهلت بزرگ تا هر دو جستجو فقط با عمق محدود شوند
+    const std::chrono::milliseconds generous_time_limit(10 * 60 * 1000);
+    RootSplitCoordinator coordinator(workers);
+    AIPlayer player1_ai(PlayerID::PLAYER_1);
+    AIPlayer player2_ai(PlayerID::PLAYER_2);
+    double total_single_s = 0.0;
+    double total_split_s = 0.0;
+
+    for (size_t p = 0; p < BENCH_POSITIONS.size(); ++p)
+    {
+        std::vector<Move> history;
+        GameState state;
+        state.initializeNewGame();
+        for (int idx : BENCH_POSITIONS[p])
+        {
+            history.push_back(Move(idx));
+            if (!state.applyMove(history.back()))
+            {
+                std::cerr << "Error: Bench position " << p << " is illegal at " << history.back().to_string() << std::endl;
+                return 1;
+            }
+        }
+
+        AIPlayer &single = (state.getCurrentPlayer() == PlayerID::PLAYER_1) ? player1_ai : player2_ai;
+        single.resetSearchState();
+        SearchLimits limits;
+        limits.time_limit = generous_time_limit;
+        limits.max_depth = depth;
+
+        auto start = std::chrono::steady_clock::now();
+        SearchReport single_report = single.analyzePosition(state, limits);
+        double single_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        SearchReport split_report = coordinator.findBestMove(history, generous_time_limit, depth);
+        double split_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        total_single_s += single_s;
+        total_split_s += split_s;
+        std::cout << "Position " << p << ": single " << single_s << " s (" << single_report.best_move.to_string()
+                  << ", " << single_report.score << "), split " << split_s << " s (" << split_report.best_move.to_string()
+                  << ", " << split_report.score << "), speedup " << (split_s > 0.0 ? single_s / split_s : 0.0) << "x" << std::endl;
+    }
+
+    std::cout << "Total with " << workers.size() << " workers: speedup "
+              << (total_split_s > 0.0 ? total_single_s / total_split_s : 0.0) << "x" << std::endl;
+    return 0;
+}
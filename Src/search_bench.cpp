@@ -0,0 +1,102 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <chrono>
+
+#include "Constants.h"
+#include "Move.h"
+#include "GameState.h"
+#include "AIPlayer.h"
+
+// Single-process search throughput (nodes per second) on a fixed set of positions.
+// Every position is searched to the same fixed depth with empty transposition tables and no time
+// limit, so node counts are reproducible and NPS can be compared between builds of the search kernels.
+//
+// Example:
+//     SquadroAI_SearchBench 9 3
+
+using namespace SquadroAI;
+
+namespace
+{
+    // Positions as move sequences from the initial position (player-relative pawn indices).
+    const std::vector<std::vector<int>> BENCH_POSITIONS = {
+        {},
+        {2, 2},
+        {0, 4, 1, 3},
+        {2, 1, 3, 0, 4, 2},
+        {1, 1, 3, 3, 2, 0, 4, 4},
+    };
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <depth> [repetitions]" << std::endl;
+        return 1;
+    }
+
+    int depth;
+    int repetitions = 1;
+    try
+    {
+        depth = std::stoi(argv[1]);
+        if (argc > 2)
+            repetitions = std::stoi(argv[2]);
+        if (depth <= 0 || repetitions <= 0)
+            throw std::invalid_argument("depth and repetitions must be positive");
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: Invalid argument. " << e.what() << std::endl;
+        return 1;
+    }
+
+    AIPlayer player1_ai(PlayerID::PLAYER_1);
+    AIPlayer player2_ai(PlayerID::PLAYER_2);
+    SearchLimits limits;
+    limits.time_limit = std::chrono::milliseconds(0);
+    limits.max_depth = depth;
+
+    long long total_nodes = 0;
+    double total_s = 0.0;
+    for (size_t p = 0; p < BENCH_POSITIONS.size(); ++p)
+    {
+        GameState state;
+        state.initializeNewGame();
+        for (int idx : BENCH_POSITIONS[p])
+        {
+            Move move(idx);
+            if (!state.applyMove(move))
+            {
+                std::cerr << "Error: Bench position " << p << " is illegal at " << move.to_string() << std::endl;
+                return 1;
+            }
+        }
+
+        AIPlayer &ai = (state.getCurrentPlayer() == PlayerID::PLAYER_1) ? player1_ai : player2_ai;
+        long long nodes = 0;
+        double seconds = 0.0;
+        SearchReport report;
+        for (int r = 0; r < repetitions; ++r)
+        {
+            ai.resetSearchState();
+            auto start = std::chrono::steady_clock::now();
+            report = ai.analyzePosition(state, limits);
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            nodes += report.nodes_searched;
+        }
+
+        total_nodes += nodes;
+        total_s += seconds;
+        std::cout << "Position " << p << ": " << report.nodes_searched << " nodes, depth " << report.depth_reached
+                  << ", best " << report.best_move.to_string() << " (" << report.score << "), "
+                  << (seconds > 0.0 ? static_cast<double>(nodes) / seconds : 0.0) << " nodes/s" << std::endl;
+    }
+
+    std::cout << "Total: " << total_nodes << " nodes in " << total_s << " s, "
+              << (total_s > 0.0 ? static_cast<double>(total_nodes) / total_s : 0.0) << " nodes/s" << std::endl;
+    return 0;
+}
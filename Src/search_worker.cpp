@@ -0,0 +1,52 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+#include "DistributedSearch.h"
+
+// Root-split search worker process.
+// Listens for RootSplitProtocol requests on the given address and answers each one with a local AIPlayer search.
+
+using namespace SquadroAI;
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <listen_ip> <port> [tt_size_mb]" << std::endl;
+        std::cerr << "Example: " << argv[0] << " 127.0.0.1 7001" << std::endl;
+        return 1;
+    }
+
+    std::string listen_ip = argv[1];
+    int port;
+    size_t tt_size_mb = 64;
+    try
+    {
+        port = std::stoi(argv[2]);
+        if (argc > 3)
+            tt_size_mb = std::stoul(argv[3]);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: Invalid argument. " << e.what() << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        SearchWorkerServer worker(tt_size_mb);
+        std::cout << "Root-split worker listening on " << listen_ip << ":" << port << std::endl;
+        if (!worker.listen(listen_ip, port))
+        {
+            std::cerr << "Error: Could not listen on " << listen_ip << ":" << port << std::endl;
+            return 1;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FATAL Unhandled std::exception in worker: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
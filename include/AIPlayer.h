@@ -1,15 +1,38 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
+#include <vector>
 #include "Constants.h"
 #include "GameState.h"
 #include "Move.h"
 #include "TranspositionTable.h"
 #include "Heuristics.h"
+#include "RaceSolver.h"
 
 namespace SquadroAI
 {
 
+    // محدودیت‌های جستجو برای یک وضعیت؛ مقدار 0 برای هر کدام (time_limit، max_depth یا max_nodes) یعنی بدون محدودیت
+    struct SearchLimits
+    {
+        std::chrono::milliseconds time_limit{1000};
+        int max_depth = 0;
+        long long max_nodes = 0;
+    };
+
+    // نتیجه تحلیل یک وضعیت (امتیاز از دید بازیکن AI)
+    struct SearchReport
+    {
+        Move best_move = NULL_MOVE;
+        int score = 0;
+        int depth_reached = 0;
+        long long nodes_searched = 0;
+        std::vector<Move> principal_variation; // از حرکت ریشه به بعد
+    };
+
+    class RootSplitCoordinator; // Forward declaration (DistributedSearch.h)
+
     class AIPlayer
     {
     public:
@@ -18,10 +41,32 @@ namespace SquadroAI
         // پیدا کردن بهترین حرکت برای وضعیت فعلی با محدودیت زمانی
         Move findBestMove(const GameState &initial_state, std::chrono::milliseconds time_limit);
 
+        // جستجو با محدودیت زمان/عمق/گره و برگرداندن امتیاز و آمار (برای تحلیل دسته‌ای)
+        SearchReport analyzePosition(const GameState &initial_state, const SearchLimits &limits);
+
+        PlayerID getPlayerID() const { return my_player_id; }
+
+        // پاک کردن جدول انتقال تا نتیجه جستجوی بعدی به جستجوهای قبلی وابسته نباشد
+        void resetSearchState();
+
+        // تبادل ورودی‌های عمیق جدول انتقال با AIPlayerهای دیگر (در پروسه‌های worker)
+        std::vector<TTEntry> exportDeepEntries(int min_depth, size_t max_count) const;
+        void importEntries(const std::vector<TTEntry> &entries);
+
+        // اگر تنظیم شود، findBestMove جستجو را بین پروسه‌های worker تقسیم می‌کند و
+        // در صورت از کار افتادن همه workerها به جستجوی محلی برمی‌گردد
+        void setRootSplitCoordinator(std::shared_ptr<RootSplitCoordinator> coordinator) { root_split_coordinator = std::move(coordinator); }
+
     private:
         PlayerID my_player_id;
         TranspositionTable transposition_table;
         long long nodes_searched_total; // برای آمار
+        std::shared_ptr<RootSplitCoordinator> root_split_coordinator;
+
+        // وضعیت جستجوی جاری
+        long long node_limit = 0; // 0 = بدون محدودیت
+        long long nodes_searched_current = 0;
+        bool search_aborted = false;
 
         struct MinimaxResult
         {
@@ -30,11 +75,22 @@ namespace SquadroAI
             bool move_found;
         };
 
-        // الگوریتم Minimax با هرس آلفا-بتا
-        MinimaxResult minimaxAlphaBeta(GameState current_state, int depth, int alpha, int beta, bool maximizing_player,
+        // الگوریتم Minimax با هرس آلفا-بتا، برای هر بازیکن نوبت‌دار جداگانه نمونه‌سازی می‌شود.
+        // امتیازها همیشه از دید my_player_id هستند. وضعیت‌های مسابقه خالص گسترش داده نمی‌شوند و نتیجه RaceSolver::solve
+        // به همین دید (و با فاصله از ریشه) تبدیل می‌شود.
+        // نوبت پس از هر حرکت عوض می‌شود (Squadro حرکت پاس ندارد)، پس فرزند با PlayerTraits<SideToMove>::OPPONENT جستجو می‌شود.
+        template <PlayerID SideToMove>
+        MinimaxResult minimaxAlphaBeta(const GameState &current_state, int depth, int alpha, int beta,
                                        std::chrono::steady_clock::time_point start_time, std::chrono::milliseconds time_limit,
                                        int current_ply_from_root);
 
+        // انتخاب نمونه minimaxAlphaBeta بر اساس بازیکن نوبت‌دار ریشه (تنها انتخاب زمان اجرا در هر تکرار)
+        MinimaxResult searchRoot(const GameState &root_state, int depth,
+                                 std::chrono::steady_clock::time_point start_time, std::chrono::milliseconds time_limit);
+
+        // استخراج PV با دنبال کردن بهترین حرکت‌های جدول انتقال از ریشه
+        std::vector<Move> extractPrincipalVariation(const GameState &root_state, const Move &root_move, int max_length) const;
+
         // مرتب‌سازی حرکات برای بهبود کارایی هرس آلفا-بتا
         void orderMoves(std::vector<Move> &moves, const GameState &state, int depth, const std::optional<TTEntry> &tt_entry);
     };
@@ -7,6 +7,7 @@ namespace SquadroAI
     constexpr int NUM_ROWS = 7; // تعداد سطرها (با احتساب خانه‌های شروع و پایان)
     constexpr int NUM_COLS = 7; // تعداد ستون‌ها
     constexpr int PIECES_PER_PLAYER = 5;
+    constexpr int PIECES_TO_WIN = 4; // بازیکنی که 4 مهره را به خانه برگرداند برنده است
 
     // شناسه‌های بازیکنان
     enum class PlayerID
@@ -28,6 +29,33 @@ namespace SquadroAI
     constexpr int PLAYER_1_BCK_POWERS[PIECES_PER_PLAYER] = {3, 1, 2, 1, 3}; // مثال
     constexpr int PLAYER_2_BCK_POWERS[PIECES_PER_PLAYER] = {1, 3, 2, 3, 1}; // مثال
 
+    // ویژگی‌های ثابت هر بازیکن برای انتخاب در زمان کامپایل (if constexpr) در مسیرهای داغ جستجو.
+    // بازیکن 1 روی سطرها از چپ به راست (ستون 0 به 6) و بازیکن 2 روی ستون‌ها از بالا به پایین (سطر 0 به 6) حرکت می‌کند.
+    template <PlayerID P>
+    struct PlayerTraits
+    {
+        static_assert(P == PlayerID::PLAYER_1 || P == PlayerID::PLAYER_2, "PlayerTraits is only defined for real players");
+
+        static constexpr PlayerID OPPONENT = (P == PlayerID::PLAYER_1) ? PlayerID::PLAYER_2 : PlayerID::PLAYER_1;
+        static constexpr int PIECE_ID_OFFSET = (P == PlayerID::PLAYER_1) ? 0 : PIECES_PER_PLAYER; // Piece::id = offset + index
+        static constexpr bool MOVES_ALONG_ROW = (P == PlayerID::PLAYER_1);                         // پیشروی روی ستون‌ها یا سطرها
+
+        static constexpr int forwardPower(int player_piece_index)
+        {
+            if constexpr (P == PlayerID::PLAYER_1)
+                return PLAYER_1_FWD_POWERS[player_piece_index];
+            else
+                return PLAYER_2_FWD_POWERS[player_piece_index];
+        }
+        static constexpr int backwardPower(int player_piece_index)
+        {
+            if constexpr (P == PlayerID::PLAYER_1)
+                return PLAYER_1_BCK_POWERS[player_piece_index];
+            else
+                return PLAYER_2_BCK_POWERS[player_piece_index];
+        }
+    };
+
     // امتیازات برای تابع ارزیابی (مقادیر اولیه، نیاز به تنظیم دقیق دارند)
     constexpr int WIN_SCORE = 100000;
     constexpr int LOSS_SCORE = -100000;
@@ -37,6 +65,11 @@ namespace SquadroAI
     constexpr int PIECE_MATERIAL_WEIGHT = 100; // ارزش داشتن مهره روی تخته
     constexpr int MOBILITY_WEIGHT = 5;
 
+    constexpr int MAX_SEARCH_DEPTH = 64; // حداکثر عمق جستجو
+    // امتیازهای در این فاصله از WIN_SCORE/LOSS_SCORE برد/باخت قطعی هستند (WIN_SCORE - تعداد ply تا پایان)؛
+    // باید از طولانی‌ترین مسابقه خالص (RaceSolver) هم بزرگ‌تر باشد
+    constexpr int DECISIVE_SCORE_MARGIN = 1000;
+
     // سایر ثابت‌های مورد نیاز
     //...
 
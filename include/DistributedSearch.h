@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <cstdint>
+#include "Constants.h"
+#include "Move.h"
+#include "AIPlayer.h"
+#include "TranspositionTable.h"
+
+// Forward declaration برای httplib برای کاهش وابستگی در هدر
+namespace httplib
+{
+    class Server;
+}
+
+namespace SquadroAI
+{
+
+    // پروتکل باینری کوچک برای تقسیم جستجو در ریشه بین پروسه‌های worker.
+    // پیام‌ها به صورت بدنه application/octet-stream روی HTTP (همان لایه cpp-httplib) ارسال می‌شوند.
+    // تمام اعداد little-endian هستند.
+    namespace RootSplitProtocol
+    {
+        constexpr uint32_t MAGIC = 0x52445153; // "SQDR"
+        constexpr uint8_t VERSION = 4;
+        constexpr const char *SEARCH_PATH = "/search";
+
+        // مقدار max_depth برای «بدون محدودیت عمق»؛ max_depth == 0 یعنی ارزیابی ایستای فرزند
+        constexpr uint16_t NO_DEPTH_LIMIT = 0xFFFF;
+        // پرچم‌های WorkRequest::flags
+        constexpr uint8_t FLAG_CLEAR_TT = 0x01; // اولین درخواست هر worker برای یک وضعیت جدید
+
+        // تبادل جدول انتقال: هر worker پس از هر کار عمیق‌ترین ورودی‌هایش را برمی‌گرداند و هماهنگ‌کننده
+        // مجموعه ادغام‌شده را همراه کار بعدی به همه workerها می‌فرستد. همه کارهای یک جستجو هم‌عمق (ply 1 یا ply 2)
+        // هستند و وضعیت‌هایشان یک بازیکن نوبت‌دار دارند، پس ورودی‌ها از یک دید هستند و مستقیماً در AIPlayer
+        // همان بازیکن وارد می‌شوند. تبادل فقط بین کارها انجام می‌شود: اگر تعداد کارها از تعداد workerها
+        // بیشتر نباشد (یک دور) هیچ تبادلی رخ نمی‌دهد.
+        constexpr int TT_EXCHANGE_MIN_DEPTH = 4;
+        constexpr size_t TT_EXCHANGE_MAX_ENTRIES = 512;
+
+        // درخواست: وضعیت به صورت دنباله حرکات از شروع بازی + حرکت ریشه‌ای که worker باید بررسی کند
+        // (و در تقسیم ply 2، یک پاسخ حریف به آن)
+        struct WorkRequest
+        {
+            std::vector<Move> move_history;
+            Move root_move = NULL_MOVE;
+            Move reply_move = NULL_MOVE; // NULL_MOVE = جستجوی کل زیردرخت root_move
+            uint32_t time_limit_ms = 0;
+            uint16_t max_depth = NO_DEPTH_LIMIT; // عمق جستجو پس از اعمال root_move (و reply_move)
+            uint8_t flags = 0;
+            std::vector<TTEntry> tt_entries; // ورودی‌های عمیق دیگر workerها، قبل از جستجو وارد می‌شوند
+        };
+
+        // پاسخ: امتیاز حرکت ریشه (یا جفت حرکت ریشه و پاسخ) از دید بازیکنی که در ریشه نوبت اوست
+        struct WorkResult
+        {
+            Move root_move = NULL_MOVE;
+            int32_t score = 0;
+            uint16_t depth_reached = 0;
+            uint64_t nodes_searched = 0;
+            std::vector<Move> principal_variation; // با root_move (و reply_move) شروع می‌شود
+            std::vector<TTEntry> tt_entries;        // عمیق‌ترین ورودی‌های جدول انتقال این worker
+        };
+
+        std::string encodeRequest(const WorkRequest &request);
+        std::string encodeResult(const WorkResult &result);
+        // در صورت خراب بودن پیام std::invalid_argument پرتاب می‌کنند
+        WorkRequest decodeRequest(const std::string &payload);
+        WorkResult decodeResult(const std::string &payload);
+    }
+
+    struct WorkerEndpoint
+    {
+        std::string host;
+        int port;
+    };
+
+    // سمت worker: درخواست‌های جستجو را دریافت کرده و با AIPlayer محلی پاسخ می‌دهد
+    class SearchWorkerServer
+    {
+    public:
+        explicit SearchWorkerServer(size_t tt_size_mb = 64);
+        ~SearchWorkerServer();
+
+        // مسدودکننده؛ تا فراخوانی stop() گوش می‌دهد
+        bool listen(const std::string &ip, int port);
+        void stop();
+
+        // جستجوی یک حرکت ریشه (برای استفاده در همین پروسه یا تست)
+        RootSplitProtocol::WorkResult handle(const RootSplitProtocol::WorkRequest &request);
+
+    private:
+        std::unique_ptr<httplib::Server> m_server;
+        std::mutex m_search_mutex; // هر worker در هر لحظه فقط یک جستجو انجام می‌دهد
+        AIPlayer m_player1_ai;
+        AIPlayer m_player2_ai;
+    };
+
+    // سمت هماهنگ‌کننده: حرکات ریشه را بین workerها پخش و نتایج را تا پایان مهلت جمع می‌کند.
+    // اگر workerها از حرکات ریشه بیشتر باشند، هر جفت (حرکت ریشه، پاسخ حریف) یک کار جداست و امتیاز هر حرکت ریشه
+    // کمینه امتیاز پاسخ‌هایش است؛ حرکت ریشه‌ای که همه پاسخ‌هایش تا مهلت کامل نشوند کنار گذاشته می‌شود.
+    // تقسیم عمیق‌تر از ply 2 وجود ندارد، پس workerهای بیش از تعداد کارهای ply 2 بیکار می‌مانند، و زیردرخت‌های
+    // پاسخ‌ها با پنجره کامل و بدون برش alpha-beta مشترک جستجو می‌شوند.
+    class RootSplitCoordinator
+    {
+    public:
+        explicit RootSplitCoordinator(std::vector<WorkerEndpoint> workers);
+
+        // move_history: حرکات از شروع بازی تا وضعیت فعلی
+        // max_depth: عمق کل جستجو از ریشه (0 = فقط محدودیت زمانی)
+        // کاری که worker آن از کار بیفتد به صف برگردانده می‌شود و آن worker تا پایان این جستجو کنار گذاشته می‌شود.
+        // هر کار بودجه سهم خود منهای حاشیه‌ای برای رفت‌وبرگشت پاسخ را می‌گیرد تا پاسخ پیش از مهلت برسد.
+        // اگر همه workerها از کار بیفتند یا هیچ حرکت ریشه‌ای پیش از مهلت کامل نشود std::runtime_error پرتاب می‌شود.
+        SearchReport findBestMove(const std::vector<Move> &move_history, std::chrono::milliseconds time_limit,
+                                  int max_depth = 0);
+        SearchReport findBestMove(const GameState &state, std::chrono::milliseconds time_limit, int max_depth = 0);
+
+    private:
+        std::vector<WorkerEndpoint> m_workers;
+    };
+
+} // namespace SquadroAI
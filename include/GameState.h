@@ -44,6 +44,22 @@ namespace SquadroAI
 
         int getCompletedPieceCount(PlayerID player) const;
 
+        // حرکات انجام‌شده از شروع بازی (برای بازسازی وضعیت در پروسه‌ای دیگر)
+        std::vector<Move> getMoveHistory() const
+        {
+            std::vector<Move> moves;
+            moves.reserve(move_history.size());
+            for (const Board::AppliedMoveInfo &info : move_history)
+                moves.push_back(info.move);
+            return moves;
+        }
+
+        const std::vector<Piece> &getPieces() const { return pieces; }
+
+        // آیا بازی به یک مسابقه خالص رسیده است؟ یعنی هیچ جفت مهره‌ای از دو بازیکن دیگر
+        // نمی‌توانند در محل تقاطع مسیرشان به هم برسند و نتیجه فقط به تعداد حرکات باقی‌مانده بستگی دارد.
+        bool isPureRace() const;
+
         uint64_t getZobristHash() const { return zobrist_hash; }
         void updateZobristHashForMove(const Move &move); // این باید پیچیده‌تر باشد
         void recomputeZobristHash();                     // برای اطمینان یا مقداردهی اولیه
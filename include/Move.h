@@ -2,6 +2,7 @@
 
 #include <string>
 #include <stdexcept>
+#include "Constants.h"
 
 namespace SquadroAI
 {
@@ -19,14 +20,12 @@ namespace SquadroAI
             }
             this->piece_index = piece_index;
         }
+        template <PlayerID P>
+        constexpr int getid() const { return PlayerTraits<P>::PIECE_ID_OFFSET + piece_index; }
+
         int getid(PlayerID player) const
         {
-            int id = piece_index;
-            if (player == PlayerID::PLAYER_2)
-            {
-                id = 5 + piece_index;
-            }
-            return id;
+            return (player == PlayerID::PLAYER_2) ? getid<PlayerID::PLAYER_2>() : getid<PlayerID::PLAYER_1>();
         }
         bool operator==(const Move &other) const { return piece_index == other.piece_index; }
 
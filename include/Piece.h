@@ -29,23 +29,35 @@ namespace SquadroAI
         Piece(PlayerID owner = PlayerID::NONE, int id = -1, int player_piece_index = -1,
               int row = 0, int col = 0) : owner(owner), id(id), player_piece_index(player_piece_index),
                                           row(row), col(col),
-                                          forward_power(forward_power), backward_power(backward_power),
-                                          status(PieceStatus::NOT_STARTED)
+                                          status(PieceStatus::NOT_STARTED),
+                                          forward_power(0), backward_power(0)
         {
             if (owner == PlayerID::PLAYER_1)
-            {
-                forward_power = PLAYER_1_FWD_POWERS[player_piece_index];
-                backward_power = PLAYER_1_BCK_POWERS[player_piece_index];
-            }
+                initPowers<PlayerID::PLAYER_1>();
             else if (owner == PlayerID::PLAYER_2)
-            {
-                forward_power = PLAYER_2_FWD_POWERS[player_piece_index];
-                backward_power = PLAYER_2_BCK_POWERS[player_piece_index];
-            }
+                initPowers<PlayerID::PLAYER_2>();
+        }
+
+        // موقعیت مهره در طول مسیر خودش (ستون برای بازیکن 1، سطر برای بازیکن 2)
+        template <PlayerID P>
+        int laneProgress() const
+        {
+            if constexpr (PlayerTraits<P>::MOVES_ALONG_ROW)
+                return col;
+            else
+                return row;
         }
 
         int getCurrentMovePower() const { return (status == PieceStatus::ON_BOARD_FORWARD) ? forward_power : backward_power; };
         bool isFinished() const { return status == PieceStatus::FINISHED; };
+
+    private:
+        template <PlayerID P>
+        void initPowers()
+        {
+            forward_power = PlayerTraits<P>::forwardPower(player_piece_index);
+            backward_power = PlayerTraits<P>::backwardPower(player_piece_index);
+        }
     };
 
 } // namespace SquadroAI
\ No newline at end of file
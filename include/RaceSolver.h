@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include "Constants.h"
+#include "Piece.h"
+#include "Move.h"
+
+namespace SquadroAI
+{
+
+    class GameState; // Forward declaration
+
+    // حل‌کننده دقیق وضعیت‌های «مسابقه خالص» (GameState::isPureRace).
+    // وقتی هیچ برخوردی ممکن نیست، هر حرکت فقط یک مهره را جلو می‌برد؛ پس تعداد نوبت‌های لازم برای هر بازیکن
+    // برابر مجموع حرکات باقی‌مانده سریع‌ترین PIECES_TO_WIN مهره اوست و نتیجه بدون جستجو مشخص می‌شود.
+    class RaceSolver
+    {
+    public:
+        struct RaceResult
+        {
+            PlayerID winner;       // بازیکن برنده با بازی بهینه هر دو طرف
+            Move best_move;        // حرکت بهینه برای بازیکنی که نوبت اوست
+            int plies_to_end;      // تعداد نیم‌حرکت تا پایان بازی
+            int score;             // امتیاز از دید بازیکنی که نوبت اوست (سازگار با WIN_SCORE/LOSS_SCORE)؛
+                                   // جستجویی که از دید بازیکن ثابتی امتیاز می‌دهد باید وقتی نوبت با حریف است آن را قرینه کند
+        };
+
+        // اگر وضعیت مسابقه خالص نباشد یا بازی تمام شده باشد std::nullopt برمی‌گرداند
+        static std::optional<RaceResult> solve(const GameState &state);
+
+        // تعداد حرکات لازم برای رساندن این مهره به خانه در صورت نبود هیچ برخوردی
+        static int remainingMoves(const Piece &piece);
+
+    private:
+        template <PlayerID P>
+        static int remainingMovesFor(const Piece &piece);
+        template <PlayerID ToMove>
+        static RaceResult solveFor(const GameState &state);
+
+        static constexpr int LANE_LENGTH = NUM_COLS - 1; // فاصله خانه شروع تا انتهای مسیر
+        static constexpr int MAX_POWER = 3;
+
+        // STEPS[power][distance] = ceil(distance / power)؛ حرکت در انتهای مسیر متوقف می‌شود
+        static constexpr std::array<std::array<int, LANE_LENGTH + 1>, MAX_POWER + 1> STEPS = []
+        {
+            std::array<std::array<int, LANE_LENGTH + 1>, MAX_POWER + 1> table{};
+            for (size_t power = 1; power <= MAX_POWER; ++power)
+                for (size_t distance = 0; distance <= LANE_LENGTH; ++distance)
+                    table[power][distance] = static_cast<int>((distance + power - 1) / power);
+            return table;
+        }();
+    };
+
+} // namespace SquadroAI
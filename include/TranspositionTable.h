@@ -24,6 +24,7 @@ namespace SquadroAI
         int depth;
         TTEntryType type;
         bool is_valid = false;
+        uint32_t generation = 0; // نسل جدول هنگام ذخیره؛ ورودی‌های نسل‌های قبلی خالی به حساب می‌آیند
 
         TTEntry() : zobrist_key_check(0), best_move(NULL_MOVE), score(0), depth(0), type(TTEntryType::EXACT) {}
     };
@@ -39,11 +40,24 @@ namespace SquadroAI
         // جستجو برای یک ورودی در جدول
         std::optional<TTEntry> probe(uint64_t zobrist_key) const;
 
-        void clear(); // پاک کردن جدول
+        void clear(); // پاک کردن جدول با O(1): فقط نسل جاری افزایش می‌یابد
+
+        // حداکثر max_count ورودی با عمق حداقل min_depth، به ترتیب نزولی عمق (برای تبادل بین workerها).
+        // فقط کلیدهای اخیراً ذخیره‌شده با عمق حداقل DEEP_KEY_MIN_DEPTH بررسی می‌شوند، پس هزینه آن
+        // به اندازه جدول بستگی ندارد و min_depth کمتر از DEEP_KEY_MIN_DEPTH بی‌اثر است.
+        std::vector<TTEntry> collectDeepEntries(int min_depth, size_t max_count) const;
+
+        static constexpr int DEEP_KEY_MIN_DEPTH = 4;
+        static constexpr size_t DEEP_KEY_CAPACITY = 4096;
 
     private:
         std::vector<TTEntry> table;
         size_t num_entries;
+        uint32_t current_generation = 1;
+        std::vector<uint64_t> deep_keys; // بافر حلقوی کلیدهای عمیق برای collectDeepEntries
+        size_t deep_keys_next = 0;
+
+        bool isLive(const TTEntry &entry) const { return entry.is_valid && entry.generation == current_generation; }
 
         size_t getIndex(uint64_t zobrist_key) const;
     };